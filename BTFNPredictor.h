@@ -0,0 +1,14 @@
+#ifndef BTFNPREDICTOR_H
+#define BTFNPREDICTOR_H
+
+//Predicts that a jXX to a lower address (a loop) is taken and one
+//to a higher address is not.
+class BTFNPredictor : public Predictor
+{
+   protected:
+      bool predictTaken(uint64_t pc, uint64_t valC, uint64_t & index);
+   public:
+      std::string getName();
+};
+
+#endif // BTFNPREDICTOR_H
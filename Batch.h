@@ -0,0 +1,30 @@
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <string>
+#include <vector>
+#include <atomic>
+
+//Runs many .yo files, each on its own Machine, on a pool of worker
+//threads.  The output of each run is compared in memory to the
+//.idump file with the same name and a summary is printed in the
+//same form as run.sh.
+class Batch
+{
+   private:
+      int32_t numThreads;
+      std::vector<std::string> files;
+      std::vector<std::string> outputs;  //output of each file's run
+      std::atomic<size_t> next;          //index of the next file to run
+      void worker();
+      static void simulate(const std::string & file, std::string & output);
+      static bool readFile(const std::string & file, std::string & text);
+   public:
+      Batch(int32_t numThreads = 0);
+      bool add(const char * path);
+      static bool listFiles(const char * path,
+                            std::vector<std::string> & files);
+      int32_t run(std::ostream & out);
+};
+
+#endif // BATCH_H
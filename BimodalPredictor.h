@@ -0,0 +1,24 @@
+#ifndef BIMODALPREDICTOR_H
+#define BIMODALPREDICTOR_H
+
+//default log2 of the number of counters
+#define BIMODALBITS 10
+//largest log2 of the number of counters
+#define BIMODALMAXBITS 24
+
+//Predicts a jXX with a table of 2-bit saturating counters indexed
+//by the address of the jXX.
+class BimodalPredictor : public Predictor
+{
+   protected:
+      std::vector<uint8_t> counters;
+      uint64_t mask;          //number of counters - 1
+      virtual uint64_t getIndex(uint64_t pc);
+      bool predictTaken(uint64_t pc, uint64_t valC, uint64_t & index);
+      void train(uint64_t index, bool taken);
+   public:
+      BimodalPredictor(int32_t bits = BIMODALBITS);
+      std::string getName();
+};
+
+#endif // BIMODALPREDICTOR_H
@@ -0,0 +1,65 @@
+#ifndef CACHE_H
+#define CACHE_H
+
+//replacement policies
+#define CACHELRU 0
+#define CACHEPLRU 1      //tree pseudo-LRU
+
+//default cycles to access main memory after a miss in the last cache
+#define MEMLATENCY 100
+//default cycles added by a hit in an L2 cache
+#define L2LATENCY 10
+
+//the shape and behavior of a cache
+struct CacheConfig
+{
+   uint64_t size;          //bytes of data (power of 2)
+   uint64_t lineSize;      //bytes in a line (power of 2)
+   uint64_t ways;          //lines in a set (power of 2, at most 64)
+   int32_t replacement;    //CACHELRU or CACHEPLRU
+   bool writeBack;         //write-back with write allocate, or
+                           //write-through without write allocate
+   uint64_t latency;       //cycles added by a hit (0 for an L1)
+};
+
+//A set-associative cache that models timing only: it keeps the tags
+//of the lines it holds, and the data stays in Memory.  access returns
+//the number of cycles an access takes beyond an L1 hit, which the
+//stage waits for by stalling the pipeline.  A miss goes to the next
+//cache, or to main memory if there is none.
+class Cache
+{
+   private:
+      std::string name;
+      CacheConfig config;
+      Cache * next;            //next level (NULL: main memory)
+      uint64_t memLatency;     //cycles to access main memory
+      uint64_t numSets;
+      int32_t lineBits;        //log2 of the line size
+      std::vector<uint64_t> tags;     //numSets * ways lines
+      std::vector<uint8_t> flags;     //LINEVALID, LINEDIRTY
+      std::vector<uint64_t> lastUse;  //LRU: time of the last access
+      std::vector<uint64_t> plru;     //PLRU: tree bits of each set
+      uint64_t time;
+      uint64_t reads;
+      uint64_t readMisses;
+      uint64_t writes;
+      uint64_t writeMisses;
+      uint64_t evictions;
+      uint64_t writebacks;
+      int64_t find(uint64_t set, uint64_t tag);
+      uint64_t victim(uint64_t set);
+      void touch(uint64_t set, uint64_t way);
+      uint64_t fill(uint64_t set, uint64_t tag);
+   public:
+      Cache(std::string name, const CacheConfig & config, Cache * next,
+            uint64_t memLatency = MEMLATENCY);
+      static bool isValid(const CacheConfig & config);
+      uint64_t access(uint64_t address, uint64_t size, bool write);
+      uint64_t getHits();
+      uint64_t getMisses();
+      uint64_t getEvictions();
+      void dump(std::ostream & out);
+};
+
+#endif // CACHE_H
@@ -11,14 +11,14 @@ class ConditionCodes
 {
    private:
       static ConditionCodes * ccInstance;
-      ConditionCodes();
       uint64_t codes;
    public:
+      ConditionCodes();
       static ConditionCodes * getInstance();      
       bool getConditionCode(int32_t ccNum, bool & error);
       void setConditionCode(bool value, int32_t ccNum, 
                             bool & error);
-      void dump();
+      void dump(std::ostream & out);
 };
 
 #endif // CONDITIONCODES_H
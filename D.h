@@ -2,13 +2,13 @@
 class D : public PipeReg
 {
    private:
-      PipeRegField * stat;
-      PipeRegField * icode;
-      PipeRegField * ifun;
-      PipeRegField * rA;
-      PipeRegField * rB;
-      PipeRegField * valC;
-      PipeRegField * valP;
+      PipeRegField stat;
+      PipeRegField icode;
+      PipeRegField ifun;
+      PipeRegField rA;
+      PipeRegField rB;
+      PipeRegField valC;
+      PipeRegField valP;
    public:
       D();
       PipeRegField * getstat();
@@ -18,5 +18,5 @@ class D : public PipeReg
       PipeRegField * getrB();
       PipeRegField * getvalC();
       PipeRegField * getvalP();
-      void dump();
+      void dump(std::ostream & out);
 };
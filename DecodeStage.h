@@ -6,9 +6,12 @@
 #include "PipeReg.h"
 
 class DecodeStage : public Stage {
+private:
+    bool E_stall;       //M is waiting for a data cache miss
 public:
-    bool doClockLow(PipeReg ** pregs, Stage ** stages);
-    void doClockHigh(PipeReg ** pregs);
+    DecodeStage();
+    bool doClockLow(Machine * machine, Stage ** stages);
+    void doClockHigh(Machine * machine);
 
     void setEInput(E *ereg, uint64_t stat, uint64_t icode,
                             uint64_t ifun, uint64_t valC, uint64_t valA,
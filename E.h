@@ -2,16 +2,16 @@
 class E : public PipeReg
 {
    private:
-      PipeRegField * stat;
-      PipeRegField * icode;
-      PipeRegField * ifun;
-      PipeRegField * valC;
-      PipeRegField * valA;
-      PipeRegField * valB;
-      PipeRegField * dstE;
-      PipeRegField * dstM;
-      PipeRegField * srcA;
-      PipeRegField * srcB;
+      PipeRegField stat;
+      PipeRegField icode;
+      PipeRegField ifun;
+      PipeRegField valC;
+      PipeRegField valA;
+      PipeRegField valB;
+      PipeRegField dstE;
+      PipeRegField dstM;
+      PipeRegField srcA;
+      PipeRegField srcB;
    public:
       E();
       PipeRegField * getstat();
@@ -24,5 +24,5 @@ class E : public PipeReg
       PipeRegField * getdstM();
       PipeRegField * getsrcA();
       PipeRegField * getsrcB();
-      void dump();
+      void dump(std::ostream & out);
 };
@@ -5,9 +5,12 @@
 #include "PipeReg.h"
 
 class ExecuteStage : public Stage {
+private:
+    bool M_stall;       //M is waiting for a data cache miss
 public:
-    bool doClockLow(PipeReg ** pregs, Stage ** stages);
-    void doClockHigh(PipeReg ** pregs);
+    ExecuteStage();
+    bool doClockLow(Machine * machine, Stage ** stages);
+    void doClockHigh(Machine * machine);
 
     void setMInput(M *mreg, uint64_t stat, uint64_t icode,
                             uint64_t Cnd, uint64_t valE, uint64_t valA,
@@ -2,9 +2,9 @@
 class F : public PipeReg
 {
    private:
-      PipeRegField * predPC;
+      PipeRegField predPC;
    public:
       F();
       PipeRegField * getpredPC();
-      void dump();
+      void dump(std::ostream & out);
 };
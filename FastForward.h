@@ -0,0 +1,36 @@
+#ifndef FASTFORWARD_H
+#define FASTFORWARD_H
+
+//value used for the stop PC when no stop address is wanted
+#define NOSTOPPC 0xffffffffffffffff
+
+//Instruction-level (functional) execution engine.  Executes
+//y86-64 instructions directly on the Memory, RegisterFile and
+//ConditionCodes state without any pipeline registers so that
+//the simulator can quickly skip to the region of a program of
+//interest and then hand off to the cycle-accurate pipeline.
+class FastForward
+{
+   private:
+      Memory * mem;
+      RegisterFile * rf;
+      ConditionCodes * cc;
+      uint64_t pc;         //address of the next instruction
+      uint64_t count;      //number of instructions executed
+      bool cnd;            //condition of the last jXX or cmovXX
+      bool cond(uint64_t ifun);
+      uint64_t readReg(uint64_t regNum);
+      void writeReg(uint64_t value, uint64_t regNum);
+      void setCC(uint64_t ifun, uint64_t valA, uint64_t valB,
+                 uint64_t valE);
+   public:
+      FastForward(Machine * machine, uint64_t pc = 0);
+      bool step();
+      uint64_t run(uint64_t maxInstrs, uint64_t stopPC = NOSTOPPC);
+      void handoff(PipeReg ** pregs);
+      uint64_t getPC();
+      uint64_t getCount();
+      bool getCnd();
+};
+
+#endif // FASTFORWARD_H
@@ -1,18 +1,33 @@
+class Predictor;
+
 // class to perform the combinational logic of
 // the Fetch stage
 class FetchStage : public Stage
 {
    private:
+      uint64_t nextTag;     //tag given to the last fetched instruction
+      uint64_t missPC;      //address of the instruction cache miss
+      uint64_t missCycles;  //cycles left until the miss is filled
+      uint64_t stallPC;     //address F holds while fetch is stalled
+      bool F_stall;
+      bool D_stall;
+      bool D_bubble;
+      void predecode(Memory * mem, uint64_t f_pc, PredecodeEntry & entry,
+                     bool & memError);
       void setDInput(D * dreg, uint64_t stat, uint64_t icode, 
                            uint64_t ifun, uint64_t rA, uint64_t rB,
                            uint64_t valC, uint64_t valP);
       // New helper prototypes:
-      uint64_t selectPC(F *freg, M *mreg, W *wreg);
-      bool need_regids(uint64_t f_icode);
-      bool need_valC(uint64_t f_icode);
+      uint64_t selectPC(F *freg, M *mreg, W *wreg, Predictor * predictor);
       uint64_t PCincrement(uint64_t f_pc, bool need_regids, bool need_valC);
       uint64_t predictPC(uint64_t f_icode, uint64_t f_valC, uint64_t f_valP);
    public:
-      bool doClockLow(PipeReg **pregs, Stage **stages);
-      void doClockHigh(PipeReg **pregs);
+      FetchStage();
+      //instruction encoding rules; also used by FastForward
+      static bool need_regids(uint64_t f_icode);
+      static bool need_valC(uint64_t f_icode);
+      bool doClockLow(Machine * machine, Stage ** stages);
+      void doClockHigh(Machine * machine);
+      uint64_t getNextTag();
+      void setNextTag(uint64_t tag);
 };
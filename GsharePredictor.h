@@ -0,0 +1,25 @@
+#ifndef GSHAREPREDICTOR_H
+#define GSHAREPREDICTOR_H
+
+//default number of outcomes in the global history
+#define GSHAREHISTORY 8
+//largest number of outcomes in the global history
+#define GSHAREMAXHISTORY 24
+
+//Bimodal counters indexed by the address of the jXX exclusive-ored
+//with the outcomes of the most recent conditional jXX instructions.
+class GsharePredictor : public BimodalPredictor
+{
+   private:
+      uint64_t history;       //most recent outcome in bit 0
+      uint64_t historyMask;
+      int32_t historyLength;
+   protected:
+      uint64_t getIndex(uint64_t pc);
+      void train(uint64_t index, bool taken);
+   public:
+      GsharePredictor(int32_t historyLength = GSHAREHISTORY);
+      std::string getName();
+};
+
+#endif // GSHAREPREDICTOR_H
@@ -0,0 +1,54 @@
+#ifndef ISSUEMODEL_H
+#define ISSUEMODEL_H
+
+//widest issue width modeled
+#define MAXISSUEWIDTH 16
+
+//reasons an issue slot (a place for an instruction in E) is idle
+#define IDLEFETCH 0      //fetch group ended (taken jump, call or width)
+#define IDLECONTROL 1    //refetch after a mispredicted jXX or a ret
+#define IDLEDATA 2       //operand computed by E not ready
+#define IDLELOAD 3       //operand loaded by M not ready
+#define IDLEPORT 4       //memory ports used by earlier instructions
+#define IDLEDRAIN 5      //after the last instruction
+#define NUMIDLE 6
+
+//Timing model of an in-order PIPE machine that fetches, issues and
+//retires up to width instructions per cycle.  Simulate feeds it the
+//instructions executed by FastForward, in program order, and it
+//places each in the earliest cycle that the slots of each stage, the
+//data and control hazards of PIPE (forwarding from E, M and W, one
+//cycle for a load/use hazard, jXX predicted taken and resolved in M,
+//ret resolved in W) and the number of memory ports allow.  The cycles
+//are counted, and so are the E slots that sat idle and why.  The
+//simulated stages don't implement those hazard rules yet, so the
+//cycles can differ from theirs (see IssueModel.C).
+class IssueModel
+{
+   private:
+      int32_t width;
+      int32_t memPorts;         //memory instructions per cycle
+      uint64_t regReady[REGSIZE];    //first cycle a reader can be in E
+      bool regLoaded[REGSIZE];       //value comes from memory
+      uint64_t ccReady;
+      uint64_t cycle;           //E cycle of the last instruction issued
+      int32_t used;             //slots used in that cycle
+      int32_t memUsed;          //memory ports used in that cycle
+      uint64_t fetchCycle;      //F cycle of the last instruction fetched
+      int32_t fetched;          //instructions fetched in that cycle
+      bool groupEnded;          //the last one ended its fetch group
+      uint64_t redirect;        //earliest cycle of the next fetch
+      uint64_t issued[MAXISSUEWIDTH];   //E cycles of the last width
+      uint64_t instructions;
+      uint64_t idle[NUMIDLE];
+      void issue(uint64_t icode, uint64_t ifun, uint64_t rA, uint64_t rB,
+                 bool taken);
+   public:
+      IssueModel(int32_t width, int32_t memPorts = 1);
+      bool execute(FastForward & ff, Memory * mem);
+      uint64_t getCycles();
+      uint64_t getInstructions();
+      void dump(std::ostream & out);
+};
+
+#endif // ISSUEMODEL_H
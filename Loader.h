@@ -1,27 +1,73 @@
 #ifndef LOADER_H
 #define LOADER_H
 
+//binary program image: extension, header magic and version
+#define IMAGEEXT ".yimg"
+#define IMAGEMAGIC "Y86IMAGE"
+#define IMAGEVERSION 1
+
+//one line of the .yo file: a pointer into the mapped file and the
+//number of characters before the newline (the line is not copied
+//and is not null terminated)
+struct LineView
+{
+   const char * text;
+   size_t size;
+};
+
+//a run of consecutive bytes loaded into memory
+struct Segment
+{
+   uint64_t address;
+   uint64_t size;
+};
+
+//the comment of a line of a .yo file that has an address
+struct ListingLine
+{
+   uint64_t address;
+   bool data;           //the line loads bytes (an instruction or data)
+   std::string text;    //the comment, without the | and outer spaces
+};
+
 class Loader
 {
    private:
-      int32_t lastAddress;  //last address stored to in memory
+      Memory * mem;         //memory that the program is loaded into
+      uint64_t nextAddress; //one past the last address stored to in memory
       bool loaded;          //set to true if .yo loaded into memory
+      std::vector<Segment> segments;  //runs of bytes loaded
+      std::vector<uint8_t> bytes;     //data of the segments, in order
+      uint64_t stored;                //number of bytes stored to memory
+      uint64_t sourceHash;            //hash of the .yo file (0 if none)
       //helper methods for checking to make sure the
       //input file is properly formed and loading
       //the input file
       bool badFile(std::string);
-      int32_t convert(std::string, int32_t, int32_t);
-      void loadLine(std::string);
-      bool hasErrors(std::string);
-      bool hasAddress(std::string);
-      bool hasData(std::string);
-      bool hasComment(std::string);
-      bool errorAddr(std::string);
-      bool errorData(std::string, int32_t &);
-      bool isSpaces(std::string, int32_t, int32_t);
+      bool hasExtension(std::string, const char *);
+      uint64_t convert(const LineView &, int32_t, int32_t);
+      void loadLine(const LineView &);
+      void storeSegment();
+      bool hasErrors(const LineView &);
+      bool hasAddress(const LineView &);
+      bool hasData(const LineView &);
+      size_t dataBegin(const LineView &);
+      size_t find(const LineView &, char, size_t);
+      bool hasComment(const LineView &);
+      bool errorAddr(const LineView &);
+      bool errorData(const LineView &, int32_t &);
+      bool isSpaces(const LineView &, int32_t, int32_t);
+      bool loadText(const char *, size_t, std::ostream &);
+      bool loadImage(const char *, uint64_t, bool);
+      static const char * mapFile(const char *, size_t &);
+      static void unmapFile(const char *, size_t);
+      static uint64_t hash(const void *, size_t, uint64_t);
    public:
-      Loader(int argc, char * argv[]);
+      Loader(int argc, char * argv[], Memory * mem,
+             std::ostream & out = std::cout, bool useCache = false);
       bool isLoaded();
+      bool saveImage(const char * file);
+      bool readListing(const char * file, std::vector<ListingLine> & listing);
 };
 
 #endif // LOADER_H
@@ -2,13 +2,13 @@
 class M : public PipeReg
 {
    private:
-      PipeRegField * stat;
-      PipeRegField * icode;
-      PipeRegField * Cnd;
-      PipeRegField * valE;
-      PipeRegField * valA;
-      PipeRegField * dstE;
-      PipeRegField * dstM;
+      PipeRegField stat;
+      PipeRegField icode;
+      PipeRegField Cnd;
+      PipeRegField valE;
+      PipeRegField valA;
+      PipeRegField dstE;
+      PipeRegField dstM;
    public:
       M();
       PipeRegField * getstat();
@@ -18,5 +18,5 @@ class M : public PipeReg
       PipeRegField * getvalA();
       PipeRegField * getdstE();
       PipeRegField * getdstM();
-      void dump();
+      void dump(std::ostream & out);
 };
@@ -0,0 +1,49 @@
+#ifndef MACHINE_H
+#define MACHINE_H
+
+class Memory;
+class RegisterFile;
+class ConditionCodes;
+class PipeReg;
+class PredecodeCache;
+class Predictor;
+class Cache;
+class Watcher;
+
+//The state of one simulated y86-64 machine: memory, register file,
+//condition codes, the F, D, E, M and W pipeline registers and the
+//predecoded instruction cache, the branch predictor and the optional
+//instruction, data and L2 caches that model memory timing, and the
+//optional Watcher that stops a run.  Each Machine is independent, so
+//several programs can be simulated at once in one process.
+class Machine
+{
+   private:
+      Memory * mem;
+      RegisterFile * rf;
+      ConditionCodes * cc;
+      PipeReg ** pregs;
+      PredecodeCache * icache;
+      Predictor * predictor;
+      Cache * instCache;         //NULL: memory accesses take no time
+      Cache * dataCache;
+      Cache * l2Cache;
+      Watcher * watcher;         //NULL: nothing stops the run early
+   public:
+      Machine();
+      ~Machine();
+      Memory * getMemory();
+      RegisterFile * getRegisterFile();
+      ConditionCodes * getConditionCodes();
+      PipeReg ** getPipeRegs();
+      PredecodeCache * getPredecodeCache();
+      Predictor * getPredictor();
+      void setPredictor(Predictor * predictor);
+      Cache * getInstCache();
+      Cache * getDataCache();
+      void setCaches(Cache * instCache, Cache * dataCache, Cache * l2Cache);
+      Watcher * getWatcher();
+      void setWatcher(Watcher * watcher);
+};
+
+#endif // MACHINE_H
@@ -1,21 +1,76 @@
 #ifndef MEMORY_H
 #define MEMORY_H
 
-//size of memory
+#include <map>
+#include <vector>
+
+//default size of memory; addresses from 0 to MEMSIZE - 1 are valid
+//(setSize can change this, up to the entire 64-bit address space)
 #define MEMSIZE 0x1000
+//number of bytes in a line of the memory dump (four 64-bit words)
+#define MEMLINE 32
+//memory is allocated in pages of PAGESIZE bytes when first written
+#define PAGESIZE 0x1000
+#define LINESPERPAGE (PAGESIZE / MEMLINE)
+//number of entries in the cache of recently used pages (power of 2)
+#define TLBSIZE 16
+
+class PredecodeCache;
+class Translator;
+class Watcher;
+
+//one allocated page of memory
+struct Page
+{
+   uint8_t bytes[PAGESIZE];
+   bool dirty[LINESPERPAGE];    //line written since takeDirtyLines
+};
+
 class Memory 
 {
    private:
       static Memory * memInstance;
-      Memory();
-      uint8_t mem[MEMSIZE];
+      uint64_t maxAddress;                 //highest valid address
+      std::map<uint64_t, Page *> pages;    //allocated pages by address
+      uint64_t tlbTag[TLBSIZE];            //page addresses of tlbPage
+      Page * tlbPage[TLBSIZE];
+      PredecodeCache * icache;   //invalidated by writes (may be NULL)
+      Translator * translator;   //told about writes (may be NULL)
+      Watcher * watcher;         //told about watched accesses (may be NULL)
+      std::vector<uint64_t> watchedPages;   //sorted page addresses
+      std::vector<uint64_t> dirtyLines;
+      //files mapped by addMapping (base address and size); their
+      //pages belong to the mapping rather than being allocated
+      std::vector<std::pair<void *, size_t> > mappings;
+      bool isMapped(Page * page);
+      Page * findPage(uint64_t address);
+      Page * allocPage(uint64_t address);
+      void markDirty(Page * page, uint64_t address);
+      void dumpLine(std::ostream & out, uint64_t address, 
+                    const uint64_t * currLine, uint64_t * prevLine,
+                    bool & star);
    public:
+      Memory();
+      ~Memory();
       static Memory * getInstance();      
-      uint64_t getLong(int32_t address, bool & error);
-      uint8_t getByte(int32_t address, bool & error);
-      void putLong(uint64_t value, int32_t address, bool & error);
-      void putByte(uint8_t value, int32_t address, bool & error);
-      void dump();
+      void setSize(uint64_t size);
+      uint64_t getMaxAddress();
+      void setPredecodeCache(PredecodeCache * icache);
+      void setTranslator(Translator * translator);
+      void setWatcher(Watcher * watcher);
+      void watchPages(uint64_t address, uint64_t size);
+      void watch(uint64_t address, uint64_t size, bool write);
+      uint64_t getLong(uint64_t address, bool & error);
+      uint8_t getByte(uint64_t address, bool & error);
+      void putLong(uint64_t value, uint64_t address, bool & error);
+      void putByte(uint8_t value, uint64_t address, bool & error);
+      void putBytes(const uint8_t * values, uint64_t address, uint64_t size,
+                    bool & error);
+      void takeDirtyLines(std::vector<uint64_t> & lines);
+      const std::map<uint64_t, Page *> & getPages();
+      void addPage(uint64_t address, Page * page);
+      void addMapping(void * base, size_t size);
+      void dump(std::ostream & out);
 };
 
 #endif // MEMORY_H
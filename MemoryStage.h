@@ -5,9 +5,17 @@
 #include "PipeReg.h"
 
 class MemoryStage : public Stage {
+private:
+    uint64_t waitCycles;    //cycles left until a data cache miss is filled
+    bool waiting;           //instruction in M is waiting for its data
+
+    bool memAccess(uint64_t icode, uint64_t valE, uint64_t valA,
+                   uint64_t & address, bool & write);
 public:
-    bool doClockLow(PipeReg ** pregs, Stage ** stages);
-    void doClockHigh(PipeReg ** pregs);
+    MemoryStage();
+    bool isWaiting();
+    bool doClockLow(Machine * machine, Stage ** stages);
+    void doClockHigh(Machine * machine);
 
       void setWInput(W *wreg, uint64_t stat, uint64_t icode,
                               uint64_t valE, uint64_t valM, uint64_t dstE, uint64_t dstM);
@@ -11,18 +11,59 @@
 //number of PipeRegisters
 #define NUMPIPEREGS 5
 
+//largest number of fields in a pipeline register (E has ten)
+#define MAXFIELDS 10
+
+class PipeRegField;
+
 //base class for the F, D, E, M, W pipeline registers
+//
+//The fields of a register are stored together in the input and
+//state arrays so that a clock edge is a single block copy for the
+//whole register.  The PipeRegField members of the descendant classes
+//refer to elements of these arrays.
+//
+//Each register also holds the tag that the fetch stage gave the
+//instruction in it (0 for a bubble).  The tag isn't part of the
+//state that is dumped; it lets the branch predictor find the
+//prediction it made for an instruction.
 class PipeReg
 {
+   private:
+      uint64_t input[MAXFIELDS];        //inputs of the fields
+      uint64_t state[MAXFIELDS];        //current state (outputs)
+      uint64_t bubbleState[MAXFIELDS];  //state after a bubble (a nop)
+      int32_t numFields;
+      uint64_t stalls;                  //number of stall signals applied
+      uint64_t bubbles;                 //number of bubble signals applied
+      uint64_t tagInput;                //tag of the instruction (not dumped)
+      uint64_t tag;
    public:
+      PipeReg();
+      virtual ~PipeReg();
+      void normal();
+      void stall();
+      void bubble();
+      int32_t getNumFields();
+      const uint64_t * getState();
+      const uint64_t * getInput();
+      void restore(const uint64_t * state, const uint64_t * input,
+                   uint64_t tag);
+      uint64_t getStalls();
+      uint64_t getBubbles();
+      void setTagInput(uint64_t tag);
+      uint64_t getTag();
       //dump method is implemented in the classes that descend
       //from PipeReg
       //
       //dump is abstract
       //virtual makes it polymorphic 
-      virtual void dump() = 0;
+      virtual void dump(std::ostream & out) = 0;
    protected:
-      void dumpField(std::string label, int width, uint64_t value, bool nl);
+      void initField(PipeRegField & field, int32_t index, 
+                     uint64_t bubbleValue = 0);
+      void dumpField(std::ostream & out, std::string label, int width,
+                     uint64_t value, bool nl);
 };
 
 #endif // PIPEREG_H
@@ -1,19 +1,25 @@
+#ifndef PIPEREGFIELD_H
+#define PIPEREGFIELD_H
+
 //class to represent a single
-//pipeline register
+//pipeline register; the values are kept in the
+//arrays of the PipeReg that the field belongs to
 class PipeRegField
 {
    private: 
-      uint64_t input;   //current input to the register
-      uint64_t state;   //current state (output)
+      uint64_t * input;   //current input to the register
+      uint64_t * state;   //current state (output)
    public:
-      //default state is 0 if none is provided
-      PipeRegField(int state = 0); 
+      PipeRegField(); 
+      void attach(uint64_t * input, uint64_t * state);
       void setInput(uint64_t input);
       uint64_t getOutput();
       void normal();
       void stall();
-      void bubble(int state = 0);
+      void bubble(uint64_t state = 0);
 };
+
+#endif // PIPEREGFIELD_H
  
 
   
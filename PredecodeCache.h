@@ -0,0 +1,48 @@
+#ifndef PREDECODECACHE_H
+#define PREDECODECACHE_H
+
+//number of entries in the predecoded instruction cache (power of 2)
+#define PDCSIZE 1024
+//longest y86-64 instruction in bytes
+#define MAXINSTRLEN 10
+
+//one predecoded instruction: the values the fetch stage
+//computes for the instruction at pc
+struct PredecodeEntry
+{
+   uint64_t pc;
+   bool valid;
+   uint64_t icode;
+   uint64_t ifun;
+   uint64_t rA;
+   uint64_t rB;
+   uint64_t valC;
+   uint64_t valP;
+   uint64_t predPC;
+   bool breakpoint;     //the Machine's Watcher has a breakpoint at pc
+};
+
+//PC-indexed, direct-mapped store of predecoded instructions used
+//by the FetchStage.  Memory invalidates entries when a write
+//touches the bytes of a cached instruction.
+class PredecodeCache
+{
+   private:
+      PredecodeEntry entries[PDCSIZE];
+      uint64_t lowPC;            //lowest address covered by an entry
+      uint64_t highPC;           //one past the highest address covered
+      uint64_t hits;
+      uint64_t misses;
+      uint64_t invalidations;
+   public:
+      PredecodeCache();
+      PredecodeEntry * lookup(uint64_t pc);
+      void insert(const PredecodeEntry & entry);
+      void invalidate(uint64_t address, int32_t size);
+      uint64_t getHits();
+      uint64_t getMisses();
+      uint64_t getInvalidations();
+      void dump(std::ostream & out);
+};
+
+#endif // PREDECODECACHE_H
@@ -0,0 +1,73 @@
+#ifndef PREDICTOR_H
+#define PREDICTOR_H
+
+//number of predictions remembered for instructions in the pipeline
+//(power of 2, larger than the number of instructions in flight)
+#define PREDSLOTS 16
+
+class ReturnStack;
+
+//a prediction made for a fetched jXX or ret
+struct Prediction
+{
+   uint64_t tag;        //tag of the instruction (0 if the slot is unused)
+   uint64_t target;     //predicted PC
+   uint64_t valC;       //target of a jXX
+   uint64_t index;      //table entry used by the direction predictor
+   uint64_t cycle;      //cycle in which the instruction was fetched
+   bool taken;          //jXX predicted taken
+   bool conditional;    //jXX is not a jmp
+   bool isReturn;
+   bool resolved;
+};
+
+//Base class of the branch predictors used by the FetchStage.
+//
+//The FetchStage calls predict for each jXX, call and ret it fetches
+//and resolveJump and resolveReturn when a jXX reaches M and a ret
+//reaches W.  The descendant classes decide whether a conditional
+//jXX is taken; the optional ReturnStack predicts ret targets.  The
+//Predictor counts the predictions that were right and the cycles
+//lost to the ones that were wrong.
+class Predictor
+{
+   private:
+      Prediction slots[PREDSLOTS];
+      ReturnStack * ras;        //NULL: ret is predicted to fall through
+      bool pushPending;         //call fetched this cycle
+      bool popPending;          //ret fetched this cycle
+      uint64_t pushValue;
+      uint64_t cycle;
+      uint64_t jumps;
+      uint64_t jumpsCorrect;
+      uint64_t jumpCycles;      //cycles lost to mispredicted jXX
+      uint64_t returns;
+      uint64_t returnsCorrect;
+      uint64_t returnCycles;    //cycles lost to mispredicted ret
+      uint64_t jumpRedirects;   //jXX after which fetch was redirected
+      uint64_t returnRedirects; //ret whose valM was fetched
+      uint64_t lastJumpTag;     //tags of the last ones counted
+      uint64_t lastReturnTag;
+      Prediction * find(uint64_t tag);
+   protected:
+      virtual bool predictTaken(uint64_t pc, uint64_t valC,
+                                uint64_t & index) = 0;
+      virtual void train(uint64_t index, bool taken);
+   public:
+      Predictor();
+      virtual ~Predictor();
+      virtual std::string getName() = 0;
+      void setReturnStack(ReturnStack * ras);
+      void clock();
+      uint64_t predict(uint64_t tag, uint64_t pc, uint64_t icode,
+                       uint64_t ifun, uint64_t valC, uint64_t valP);
+      void commit();
+      bool resolveJump(uint64_t tag, bool taken, uint64_t valA,
+                       uint64_t & target);
+      bool resolveReturn(uint64_t tag, uint64_t valM);
+      uint64_t getJumpRedirects();
+      uint64_t getReturnRedirects();
+      void dump(std::ostream & out);
+};
+
+#endif // PREDICTOR_H
@@ -0,0 +1,82 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+class PipeReg;
+struct ListingLine;
+
+//largest PC given its own counters; the cycles of PCs above it are
+//counted together
+#define PROFILEMAXPC 0x1000000
+//deepest shadow call stack kept; deeper calls are charged to the
+//function at this depth
+#define PROFILEMAXDEPTH 256
+//tags of the instructions in flight remembered (a power of 2 larger
+//than the number of pipeline registers)
+#define PROFILETAGS 16
+//number of possible icodes
+#define PROFILEICODES 16
+
+//cycles charged to one PC
+struct PCCycles
+{
+   uint64_t retire;     //W held the instruction
+   uint64_t stall;      //W held a bubble charged to it
+};
+
+//Guest program profiler.  Simulate calls start before the first
+//cycle and beginCycle before every cycle; like Stats it only reads
+//the pipeline registers, so the stages do nothing extra.
+//
+//Every cycle is charged to one PC.  A cycle in which W holds an
+//instruction is charged to it (retire); a cycle in which W holds a
+//bubble is charged (stall) to the instruction waiting in M if it
+//didn't move, and otherwise to the last instruction retired, which
+//is the jXX that was mispredicted, the ret or the load that caused
+//the bubble.  The PC of an instruction is found from its tag: D
+//holds every instruction fetched for at least a cycle, and its PC
+//is valP less its length.
+//
+//A shadow call stack follows the call and ret instructions that
+//retire.  The stacks are kept as a tree of nodes (function entry PC
+//and parent) and each cycle is added to the node of the current
+//stack, so nothing is allocated per cycle: the counters are flat
+//arrays indexed by PC or node, which grow only when a higher PC or a
+//new stack is first seen.
+class Profiler
+{
+   private:
+      std::vector<PCCycles> pcCycles;       //indexed by PC
+      uint64_t otherCycles;                 //PCs above PROFILEMAXPC
+      uint64_t tagPC[PROFILETAGS];          //PC of each tag in flight
+      uint64_t tagSeen[PROFILETAGS];        //the tag stored in each slot
+      uint64_t length[PROFILEICODES];       //bytes in each instruction
+      uint64_t lastPC;                      //last instruction retired
+      uint64_t lastMTag;                    //tag in M in the last cycle
+      uint64_t cycles;
+      uint64_t instructions;
+      //the call stack tree; node 0 is the stack at start
+      std::vector<uint64_t> nodeFunc;       //entry PC of the function
+      std::vector<uint32_t> nodeParent;
+      std::vector<uint64_t> nodeCycles;
+      std::map<std::pair<uint32_t, uint64_t>, uint32_t> children;
+      std::vector<uint32_t> stack;          //nodes of the current stack
+      uint32_t node;                        //top of stack
+      uint64_t extraDepth;                  //calls beyond PROFILEMAXDEPTH
+      bool callPending;                     //next retired PC is an entry
+      bool returnPending;                   //pop before the next one
+      std::unordered_map<uint64_t, std::string> instrText;
+      std::unordered_map<uint64_t, std::string> labels;
+      uint64_t lookup(uint64_t tag);
+      void charge(uint64_t pc, bool retired);
+      void call(uint64_t entry);
+      std::string name(uint64_t pc);
+   public:
+      Profiler();
+      void setListing(const std::vector<ListingLine> & listing);
+      void start(PipeReg ** pregs);
+      void beginCycle(PipeReg ** pregs);
+      void dump(std::ostream & out, uint32_t count);
+      void writeFolded(std::ostream & out);
+};
+
+#endif // PROFILER_H
@@ -27,14 +27,16 @@ class RegisterFile
 {
    private:
       static RegisterFile * regInstance;
-      RegisterFile();
       uint64_t reg[REGSIZE];
+      static const char * rnames[REGSIZE];
    public:
+      RegisterFile();
       static RegisterFile * getInstance();      
       uint64_t readRegister(int32_t regNumber, bool & error);
       void writeRegister(uint64_t value, int32_t regNumber, 
                         bool & error);
-      void dump();
+      void dumpRegister(std::ostream & out, int32_t regNumber);
+      void dump(std::ostream & out);
 };
 
 #endif // REGISTERFILE_H
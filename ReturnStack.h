@@ -0,0 +1,23 @@
+#ifndef RETURNSTACK_H
+#define RETURNSTACK_H
+
+//default number of return addresses kept
+#define RASDEPTH 16
+
+//Fixed size stack of return addresses used to predict the target
+//of a ret.  When it is full a push discards the oldest address.
+class ReturnStack
+{
+   private:
+      std::vector<uint64_t> entries;
+      int32_t topIndex;     //index of the top entry
+      int32_t count;        //number of entries in use
+   public:
+      ReturnStack(int32_t depth = RASDEPTH);
+      void push(uint64_t address);
+      void pop();
+      uint64_t top();
+      bool isEmpty();
+};
+
+#endif // RETURNSTACK_H
@@ -0,0 +1,67 @@
+#ifndef SIMDBATCH_H
+#define SIMDBATCH_H
+
+//lanes held in one AVX2 register (four 64-bit values); the lane
+//arrays are padded to a multiple of this
+#define SIMDWIDTH 4
+
+//one decoded instruction, the same for every lane that executes it
+struct SimdInstr
+{
+   uint64_t pc;
+   uint64_t icode;
+   uint64_t ifun;
+   uint64_t rA;
+   uint64_t rB;
+   uint64_t valC;
+   uint64_t valP;
+   uint8_t bytes[MAXINSTRLEN];   //the encoding, to find matching lanes
+};
+
+//Runs many programs together, one per lane, by executing their
+//instructions functionally in lock step.  The registers, condition
+//codes and PCs of all of the lanes are kept in structure-of-arrays
+//form, so an instruction is executed for all of the lanes at that PC
+//at once, using AVX2 kernels for the ALU operations, conditional
+//moves and jumps when the host has them.  Each lane has its own
+//Machine for its memory.  When a lane stops (at its halt), its state
+//is handed to the pipeline of its Machine, which simulates the last
+//few cycles and outputs the final dump.
+class SimdBatch
+{
+   private:
+      bool vector;                       //use the AVX2 kernels
+      std::vector<std::string> files;
+      std::vector<Machine *> machines;   //one per lane
+      std::vector<std::string> loadText; //output of each lane's Loader
+      std::vector<bool> loaded;
+      size_t lanes;
+      size_t width;                      //lanes rounded up to SIMDWIDTH
+      //register r of lane i is regs[r * width + i]; row RNONE is all 0
+      std::vector<uint64_t> regs;
+      std::vector<uint64_t> zf;          //condition codes (0 or 1)
+      std::vector<uint64_t> sf;
+      std::vector<uint64_t> of;
+      std::vector<uint64_t> pc;
+      std::vector<uint64_t> count;       //instructions executed
+      std::vector<uint64_t> active;      //~0 while the lane runs, else 0
+      std::vector<uint64_t> mask;        //~0 for the lanes executing
+      std::vector<uint64_t> taken;       //scratch: condition held
+      uint64_t steps;
+      void load();
+      bool decode(Memory * mem, uint64_t address, SimdInstr & instr);
+      bool matches(Memory * mem, const SimdInstr & instr);
+      void execute(const SimdInstr & instr);
+      void executeMemory(const SimdInstr & instr);
+      void finish(size_t lane, uint64_t cycleLimit, std::ostream & out);
+   public:
+      SimdBatch(bool vector = true);
+      ~SimdBatch();
+      bool add(const char * path);
+      void run(uint64_t maxInstrs, uint64_t cycleLimit, std::ostream & out);
+      bool usesVector();
+      uint64_t getSteps();
+      uint64_t getInstructions();
+};
+
+#endif // SIMDBATCH_H
@@ -1,13 +1,39 @@
+class IssueModel;
+class Profiler;
+
 //Driver class for the yess simulator
 class Simulate
 {
    private:
-      PipeReg ** pregs;
+      Machine * machine;
       Stage ** stages;
+      Trace * trace;
+      Stats * stats;
+      uint64_t cycle;            //cycles simulated
+      uint64_t instructions;     //instructions retired
+      uint64_t cycleLimit;       //stop after this cycle count (0 for none)
+      bool translate;            //fastForward uses the Translator
+      IssueModel * issueModel;   //fed by fastForward (NULL for none)
+      Profiler * profiler;       //told about every cycle (NULL for none)
+      const char * snapshotFile; //snapshot to write (NULL for none)
+      int32_t snapshotWhen;      //SNAPCYCLE, SNAPINSTR or SNAPPC
+      uint64_t snapshotValue;
+      void checkSnapshot();
    public:
-      Simulate();
+      Simulate(Machine * machine);
+      ~Simulate();
+      void setTrace(Trace * trace);
+      void setStats(Stats * stats);
+      void setSnapshot(const char * file, int32_t when, uint64_t value);
+      bool restore(const char * file);
+      void setCycleLimit(uint64_t limit);
+      void setTranslate(bool translate);
+      void setIssueModel(IssueModel * issueModel);
+      void setProfiler(Profiler * profiler);
+      uint64_t getCycle();
+      uint64_t getInstructions();
+      uint64_t fastForward(uint64_t numInstrs, uint64_t stopPC);
       void run();
       bool doClockLow();
       void doClockHigh();
-      void dumpPipeRegs();
 };
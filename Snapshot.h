@@ -0,0 +1,53 @@
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+//extension of snapshot files
+#define SNAPEXT ".ysnap"
+//first 8 bytes of a snapshot file
+#define SNAPMAGIC "Y86SNAPS"
+#define SNAPVERSION 1
+
+//when a snapshot is written (see Simulate::setSnapshot)
+#define SNAPCYCLE 0     //after the given number of cycles
+#define SNAPINSTR 1     //after the given number of retired instructions
+#define SNAPPC 2        //when the instruction at the given PC is next
+
+//start of a snapshot file.  It is followed by the addresses of the
+//numPages pages (uint64_t each) and then the pages themselves (Page
+//structs, pageSize bytes each).  Every field is 8 bytes so the pages
+//are 8-byte aligned in the file.
+struct SnapshotHeader
+{
+   char magic[8];
+   uint64_t version;
+   uint64_t pageSize;                      //sizeof(Page)
+   uint64_t cycle;                         //cycles simulated
+   uint64_t instructions;                  //instructions retired
+   uint64_t maxAddress;                    //highest valid address
+   uint64_t codes;                         //OF, SF and ZF bits
+   uint64_t regs[REGSIZE];
+   uint64_t pipeState[NUMPIPEREGS][MAXFIELDS];
+   uint64_t pipeInput[NUMPIPEREGS][MAXFIELDS];
+   uint64_t pipeTag[NUMPIPEREGS];
+   uint64_t nextTag;                       //tag of the last fetched instruction
+   uint64_t numPages;
+};
+
+//Writes the state of a Machine to a file and restores a Machine
+//from one.  The pages are stored exactly as Memory holds them, so
+//restore maps the file and gives the pages to Memory without copying
+//or parsing them; they are copied only when the simulation writes
+//them.
+class Snapshot
+{
+   private:
+      Machine * machine;
+   public:
+      Snapshot(Machine * machine);
+      bool save(const char * file, uint64_t cycle, uint64_t instructions,
+                uint64_t nextTag);
+      bool restore(const char * file, uint64_t & cycle,
+                   uint64_t & instructions, uint64_t & nextTag);
+};
+
+#endif // SNAPSHOT_H
@@ -10,13 +10,19 @@
 //five stages: FetchStage, DecodeStage, ExecuteStage,
 //             MemoryStage, WritebackStage
 #define NUMSTAGES 5
+
+class Machine;
+
 class Stage
 {
    public:
       //abstract methods implemented in the descendant classes
       //virtual makes these methods polymorphic       
-      virtual bool doClockLow(PipeReg ** pregs, Stage ** stages) = 0;
-      virtual void doClockHigh(PipeReg ** pregs) = 0;
+      //the Machine holds the pipeline registers (and memory,
+      //register file and condition codes) that the stage uses
+      virtual bool doClockLow(Machine * machine, Stage ** stages) = 0;
+      virtual void doClockHigh(Machine * machine) = 0;
+      virtual ~Stage() {}
 };
 
 #endif // STAGE_H
@@ -0,0 +1,67 @@
+#ifndef STATS_H
+#define STATS_H
+
+#include <chrono>
+
+class Predictor;
+
+//report formats
+#define STATSJSON 0
+#define STATSCSV 1
+
+//number of possible icodes
+#define NUMICODES 16
+
+//the values counted by Stats
+struct Counters
+{
+   uint64_t cycles;
+   uint64_t retired;                 //instructions that reached W
+   uint64_t stalls[NUMPIPEREGS];     //stall signals applied to each register
+   uint64_t bubbles[NUMPIPEREGS];    //bubble signals applied to each register
+   uint64_t loadUse;                 //load/use hazard stalls
+   uint64_t mispredicts;             //mispredicted IJXX
+   uint64_t iretRefetches;           //IRET targets fetched from W (not
+                                     //predicted by a return stack)
+   uint64_t icodes[NUMICODES];       //retired instructions by icode
+};
+
+//Performance counters for a simulation.  Simulate calls beginCycle
+//and endCycle around every cycle and report after the last one.
+//The counters are derived from the pipeline registers (and the
+//stall and bubble counts kept by PipeReg) and from the redirects
+//counted by the Predictor, so the stages do nothing extra and a
+//simulation without a Stats costs nothing.
+class Stats
+{
+   private:
+      std::ostream * out;
+      int32_t format;
+      uint64_t interval;      //report every interval cycles (0 for none)
+      bool header;            //CSV header has been output
+      Counters counters;
+      Predictor * predictor;
+      uint64_t startJumps;       //Predictor counts at start
+      uint64_t startReturns;
+      Counters lastReport;    //counters at the last interval report
+      bool valid[NUMPIPEREGS];   //register holds a fetched instruction
+      uint64_t regStalls[NUMPIPEREGS];   //PipeReg counts at the last cycle
+      uint64_t regBubbles[NUMPIPEREGS];
+      std::chrono::steady_clock::time_point startTime;
+      std::chrono::steady_clock::time_point lastTime;
+      void write(const char * label, const Counters & values, double seconds);
+      void writeJSON(const char * label, const Counters & values,
+                     double seconds);
+      void writeCSV(const char * label, const Counters & values,
+                    double seconds);
+   public:
+      Stats(int32_t format = STATSJSON, uint64_t interval = 0,
+            std::ostream & out = std::cout);
+      void start(PipeReg ** pregs, Predictor * predictor);
+      void beginCycle(PipeReg ** pregs);
+      void endCycle(PipeReg ** pregs);
+      void report();
+      const Counters & getCounters();
+};
+
+#endif // STATS_H
@@ -0,0 +1,13 @@
+#ifndef TAKENPREDICTOR_H
+#define TAKENPREDICTOR_H
+
+//Predicts that every jXX is taken (the default).
+class TakenPredictor : public Predictor
+{
+   protected:
+      bool predictTaken(uint64_t pc, uint64_t valC, uint64_t & index);
+   public:
+      std::string getName();
+};
+
+#endif // TAKENPREDICTOR_H
@@ -0,0 +1,42 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+//trace levels
+#define TRACEFULL 0     //full dump (default)
+#define TRACEFINAL 1    //full dump of the final state only
+#define TRACEDIFF 2     //changed registers and memory lines only
+#define TRACEBINARY 3   //compact binary records
+
+//binary trace header
+#define TRACEMAGIC "Y86TRACE"
+#define TRACEVERSION 2
+
+//Decides what state is output at the end of each cycle and
+//writes it through a TraceWriter.
+class Trace
+{
+   private:
+      TraceWriter * writer;
+      std::ostream * out;
+      int32_t level;
+      uint64_t interval;      //dump every interval cycles
+      bool first;             //no dump has been done yet
+      std::string pregText[NUMPIPEREGS];
+      uint64_t regs[REGSIZE];
+      uint64_t codes;
+      std::vector<uint64_t> lines;   //dirty memory lines
+      uint64_t getCodes(ConditionCodes * cc);
+      void snapshot(Machine * machine);
+      void dumpFull(uint64_t cycle, Machine * machine);
+      void dumpDiff(uint64_t cycle, Machine * machine);
+      void dumpBinary(uint64_t cycle, Machine * machine);
+   public:
+      Trace(int32_t level = TRACEFULL, uint64_t interval = 1,
+            FILE * file = stdout, bool background = false);
+      ~Trace();
+      void endCycle(uint64_t cycle, bool last, Machine * machine);
+      std::ostream & getStream();
+      void close();
+};
+
+#endif // TRACE_H
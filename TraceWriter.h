@@ -0,0 +1,44 @@
+#ifndef TRACEWRITER_H
+#define TRACEWRITER_H
+
+#include <cstdio>
+#include <streambuf>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+//size of each block of trace output handed to the file
+#define TRACEBLOCK 0x10000
+
+//Buffered output for the simulator trace.  Text is written through
+//a std::ostream attached to the TraceWriter (it is a streambuf) and
+//binary records through write.  Output is collected in TRACEBLOCK
+//sized blocks; std::endl does not force a write.  If background is
+//true the blocks are written to the file by a separate thread.
+class TraceWriter : public std::streambuf
+{
+   private:
+      FILE * file;
+      bool background;
+      bool closed;
+      std::vector<char> buffer;
+      std::thread writer;
+      std::mutex lock;
+      std::condition_variable ready;
+      std::deque<std::vector<char> > queue;
+      bool done;
+      void flushBuffer();
+      void writerLoop();
+   protected:
+      int overflow(int c);
+      int sync();
+   public:
+      TraceWriter(FILE * file, bool background);
+      ~TraceWriter();
+      void write(const void * data, size_t size);
+      void close();
+};
+
+#endif // TRACEWRITER_H
@@ -0,0 +1,85 @@
+#ifndef TRANSLATOR_H
+#define TRANSLATOR_H
+
+//most instructions translated into one block
+#define MAXBLOCKINSTRS 64
+//translations kept before the cache is flushed
+#define MAXBLOCKS 65536
+//register index that reads as 0 (RNONE) and one that absorbs writes
+#define TREGNONE 15
+#define TREGSINK 16
+
+class Memory;
+class RegisterFile;
+class ConditionCodes;
+class PipeReg;
+class Machine;
+
+//one translated instruction.  kind selects the operation (the
+//condition is part of it for cmovXX and jXX) and rA, rB and dst index
+//the register array, with RNONE mapped to TREGNONE when it is read
+//and TREGSINK when it is written.
+struct TransOp
+{
+   uint8_t kind;
+   uint8_t rA;         //registers read
+   uint8_t rB;
+   uint8_t dst;        //register written
+   uint64_t pc;        //address of the instruction
+   uint64_t valC;
+   uint64_t valP;      //address of the next instruction
+};
+
+//a translated basic block: the instructions from pc up to and
+//including the first jXX, call or ret (or MAXBLOCKINSTRS of them).
+//A block that reaches an instruction that can't be executed (halt,
+//an invalid instruction or one that can't be fetched) ends with a
+//TSTOP op for it.
+struct TransBlock
+{
+   uint64_t pc;
+   uint64_t end;                 //one past the last byte translated
+   uint64_t count;               //instructions, not counting a TSTOP
+   bool valid;                   //false once the code has been written
+   std::vector<TransOp> ops;
+   TransBlock * taken;           //block at the jXX or call target
+   TransBlock * next;            //block at the address after the block
+   TransBlock * returnTo;        //block the ret went to last time
+};
+
+//Executes y86-64 instructions by translating each basic block once
+//into a compact threaded form that is executed without decoding it
+//again.  Blocks are chained: the end of a block remembers the block
+//that follows it, so most blocks are entered without a lookup.
+//Memory tells the Translator about every write so translations of
+//code that is changed are discarded.  The results are those of
+//FastForward, which the Translator can be used in place of.
+class Translator
+{
+   private:
+      Memory * mem;
+      RegisterFile * rf;
+      ConditionCodes * cc;
+      uint64_t pc;         //address of the next instruction
+      uint64_t count;      //number of instructions executed
+      std::unordered_map<uint64_t, TransBlock *> blocks;   //valid, by pc
+      std::unordered_map<uint64_t, std::vector<TransBlock *> > pageBlocks;
+      std::vector<TransBlock *> allBlocks;    //including invalid ones
+      uint64_t lowPC;      //lowest address translated
+      uint64_t highPC;     //one past the highest address translated
+      bool codeChanged;    //a translated block was invalidated
+      uint64_t generation; //changed by every flush
+      TransBlock * lookup(uint64_t pc);
+      TransBlock * translate(uint64_t pc);
+      void flush();
+   public:
+      Translator(Machine * machine, uint64_t pc = 0);
+      ~Translator();
+      uint64_t run(uint64_t maxInstrs, uint64_t stopPC);
+      void invalidate(uint64_t address, uint64_t size);
+      void handoff(PipeReg ** pregs);
+      uint64_t getPC();
+      uint64_t getCount();
+};
+
+#endif // TRANSLATOR_H
@@ -2,12 +2,12 @@
 class W : public PipeReg
 {
    private:
-      PipeRegField * stat;
-      PipeRegField * icode;
-      PipeRegField * valE;
-      PipeRegField * valM;
-      PipeRegField * dstE;
-      PipeRegField * dstM;
+      PipeRegField stat;
+      PipeRegField icode;
+      PipeRegField valE;
+      PipeRegField valM;
+      PipeRegField dstE;
+      PipeRegField dstM;
    public:
       W();
       PipeRegField * getstat();
@@ -16,5 +16,5 @@ class W : public PipeReg
       PipeRegField * getvalM();
       PipeRegField * getdstE();
       PipeRegField * getdstM();
-      void dump();
+      void dump(std::ostream & out);
 };
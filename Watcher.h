@@ -0,0 +1,79 @@
+#ifndef WATCHER_H
+#define WATCHER_H
+
+class Memory;
+class Machine;
+
+//accesses a watchpoint stops on
+#define WATCHREAD 1
+#define WATCHWRITE 2
+
+//breakpoint hits remembered until their instruction reaches W (more
+//than the number of instructions in flight)
+#define WATCHPENDING 8
+
+//comparisons in register conditions
+#define WATCHEQ 0
+#define WATCHNE 1
+#define WATCHLT 2
+#define WATCHLE 3
+#define WATCHGT 4
+#define WATCHGE 5
+
+//a range of memory to watch
+struct Watchpoint
+{
+   uint64_t address;
+   uint64_t size;
+   int32_t access;      //WATCHREAD, WATCHWRITE or both
+};
+
+//a condition on the value of a register (unsigned comparison)
+struct RegisterCondition
+{
+   int32_t reg;
+   int32_t compare;     //WATCHEQ, WATCHNE, ...
+   uint64_t value;
+   std::string text;    //as given, for the report
+};
+
+//Conditions that stop a simulation: breakpoints on the PC of
+//executed instructions, watchpoints on memory accessed by the M stage
+//and conditions on register values.  The checks cost nothing unless
+//they are set: a breakpoint is marked in the predecoded entry of its
+//instruction, so the FetchStage tells the Watcher only about fetches
+//of marked PCs; Memory passes on only the accesses to pages that hold
+//a watchpoint; and the register conditions are tested by Simulate at
+//the end of a cycle only if there are any.  A breakpoint fires when
+//its instruction reaches W, so an instruction fetched on a
+//mispredicted path (and then bubbled) never stops the run.  When one
+//of them fires the run stops at the end of that cycle, so the trace
+//dumps the state, and dump tells why.
+class Watcher
+{
+   private:
+      std::unordered_set<uint64_t> breakpoints;
+      std::vector<Watchpoint> watchpoints;
+      std::vector<RegisterCondition> conditions;
+      uint64_t pendingTag[WATCHPENDING];  //fetched breakpoints (0: none)
+      uint64_t pendingPC[WATCHPENDING];
+      int32_t nextPending;
+      bool fired;
+      std::string reason;
+      uint64_t cycle;      //cycle in which it fired
+   public:
+      Watcher();
+      void addBreakpoint(uint64_t pc);
+      void addWatchpoint(uint64_t address, uint64_t size, int32_t access);
+      void addCondition(int32_t reg, int32_t compare, uint64_t value,
+                        const std::string & text);
+      void attach(Machine * machine);
+      bool isBreakpoint(uint64_t pc);
+      void fetch(uint64_t pc, uint64_t tag);
+      void access(uint64_t address, uint64_t size, bool write);
+      bool check(Machine * machine, uint64_t cycle);
+      bool hasFired();
+      void dump(std::ostream & out);
+};
+
+#endif // WATCHER_H
@@ -6,8 +6,8 @@
 
 class WritebackStage : public Stage {
 public:
-    bool doClockLow(PipeReg ** pregs, Stage ** stages);
-    void doClockHigh(PipeReg ** pregs);
+    bool doClockLow(Machine * machine, Stage ** stages);
+    void doClockHigh(Machine * machine);
 };
 
 #endif
\ No newline at end of file
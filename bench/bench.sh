@@ -0,0 +1,101 @@
+#!/bin/bash
+#
+# Measures how fast yess simulates the workloads made by gen.sh.
+#
+# Usage: bench.sh [-u] [-t <percent>] [-c <cycles>] [-r <runs>] [yess]
+#
+# Each workload is run <runs> times (default 5) for at most <cycles>
+# cycles (default 2000000) with the trace going to /dev/null, and the
+# fastest run is reported: host time, simulated cycles per second and
+# retired instructions per second (from the -S counters).  Each rate
+# is compared with bench/baseline.csv; the script fails if a workload
+# runs more than <percent> (default 10) slower than its baseline.
+# -u writes the measured rates to the baseline instead.
+#
+# yess is the simulator to measure (default ./yess-opt, the optimized
+# build made by make yess-opt).
+
+dir=$(dirname "$0")
+baseline="$dir/baseline.csv"
+update=0
+threshold=10
+cycles=2000000
+runs=5
+
+while getopts "ut:c:r:" opt
+do
+   case $opt in
+      u) update=1 ;;
+      t) threshold=$OPTARG ;;
+      c) cycles=$OPTARG ;;
+      r) runs=$OPTARG ;;
+      *) echo "Usage: bench.sh [-u] [-t <percent>] [-c <cycles>] [-r <runs>] [yess]"
+         exit 2 ;;
+   esac
+done
+shift $((OPTIND - 1))
+yess=${1:-./yess-opt}
+
+if [ ! -x "$yess" ]; then
+   echo "$yess not found; build it with make yess-opt"
+   exit 2
+fi
+
+work=$(mktemp -d)
+trap 'rm -rf "$work"' EXIT
+"$dir/gen.sh" "$work" || exit 2
+
+workloads=( alu memcpy recursion branch pushpop )
+numFailed=0
+results=""
+
+printf "%-10s %10s %10s %9s %14s %14s %14s %8s\n" workload cycles instrs \
+       seconds cycles/s instrs/s baseline change
+for workload in ${workloads[@]}
+do
+   best=""
+   for ((run = 0; run < runs; run++))
+   do
+      "$yess" "$work/$workload.yo" -T final -o /dev/null -L $cycles \
+              -S csv -s "$work/stats.csv" > /dev/null
+      # the total row: cycles, instructions, ..., seconds, cyclesPerSecond
+      row=$(awk -F, '$1 == "total" { print $2, $3, $(NF - 1) }' "$work/stats.csv")
+      if [ -z "$row" ]; then
+         echo "Testing $workload ... no counters from $yess"
+         exit 2
+      fi
+      seconds=${row##* }
+      if [ -z "$best" ] || awk "BEGIN { exit !($seconds < ${best##* }) }"; then
+         best=$row
+      fi
+   done
+   read simCycles instrs seconds <<< "$best"
+   cps=$(awk "BEGIN { printf \"%.0f\", $simCycles / $seconds }")
+   ips=$(awk "BEGIN { printf \"%.0f\", $instrs / $seconds }")
+   results+="$workload,$cps,$ips"$'\n'
+
+   base=$(awk -F, -v w=$workload '$1 == w { print $2 }' "$baseline" 2>/dev/null)
+   change="-"
+   if [ -n "$base" ] && [ $update -eq 0 ]; then
+      change=$(awk "BEGIN { printf \"%+.1f%%\", 100 * ($cps - $base) / $base }")
+      if awk "BEGIN { exit !($cps < $base * (1 - $threshold / 100)) }"; then
+         change="$change FAIL"
+         numFailed=$((numFailed + 1))
+      fi
+   fi
+   printf "%-10s %10s %10s %9.4f %14s %14s %14s %8s\n" $workload $simCycles \
+          $instrs $seconds $cps $ips "${base:--}" "$change"
+done
+
+if [ $update -eq 1 ]; then
+   echo "workload,cyclesPerSecond,instructionsPerSecond" > "$baseline"
+   echo -n "$results" >> "$baseline"
+   echo "Baseline written to $baseline"
+   exit 0
+fi
+echo " "
+if [ $numFailed -ne 0 ]; then
+   echo "$numFailed workloads ran more than $threshold% slower than the baseline."
+   exit 1
+fi
+echo "No workload ran more than $threshold% slower than the baseline."
@@ -0,0 +1,210 @@
+#!/bin/bash
+#
+# Generates the benchmark workloads: one .yo file per workload in the
+# directory given as the argument (default: bench/yo).
+#
+#   alu       - tight loop of OPq instructions
+#   memcpy    - copies an array with mrmovq/rmmovq, over and over
+#   recursion - deep call/ret recursion, over and over
+#   branch    - data dependent conditional jumps
+#   pushpop   - pushq/popq of several registers per iteration
+#
+# Each workload loops ITERS times (default 1000000) and then halts.
+# The instructions are assembled here (two passes, so labels can be
+# used before they are defined) in the format written by yas.
+
+out=${1:-$(dirname "$0")/yo}
+iters=${ITERS:-1000000}
+mkdir -p "$out" || exit 1
+
+declare -A R=( [rax]=0 [rcx]=1 [rdx]=2 [rbx]=3 [rsp]=4 [rbp]=5 [rsi]=6
+               [rdi]=7 [r8]=8 [r9]=9 [r10]=a [r11]=b [r12]=c [r13]=d
+               [r14]=e )
+declare -A label
+pass=1
+pc=0
+file=""
+
+# le64 <value> - the 8 bytes of value in little endian order (hex)
+le64()
+{
+   local v=$(printf "%016x" $(( $1 )))
+   local bytes=""
+   for ((i = 14; i >= 0; i -= 2)); do bytes+=${v:i:2}; done
+   echo -n "$bytes"
+}
+
+# value <number|label>
+value()
+{
+   if [[ $1 =~ ^-?[0-9] ]]; then echo $(( $1 )); else echo $(( ${label[$1]:-0} )); fi
+}
+
+# emit <bytes> <source> - one line of the .yo file
+emit()
+{
+   if [ $pass -eq 2 ]; then printf "0x%03x: %-21s| %s\n" $pc "$1" "$2" >> "$file"; fi
+   pc=$(( pc + ${#1} / 2 ))
+}
+
+lab()    { label[$1]=$pc; [ $pass -eq 2 ] && printf "0x%03x: %21s| %s:\n" $pc "" "$1" >> "$file"; }
+pos()    { pc=$(( $1 )); [ $pass -eq 2 ] && printf "%28s| .pos %s\n" "" "$1" >> "$file"; }
+halt()   { emit 00 "halt"; }
+ret()    { emit 90 "ret"; }
+irmovq()
+{
+   local source=$1
+   [[ $1 =~ ^-?[0-9] ]] && source="\$$1"
+   emit 30f${R[$2]}$(le64 $(value $1)) "irmovq $source, %$2"
+}
+rrmovq() { emit 20${R[$1]}${R[$2]} "rrmovq %$1, %$2"; }
+rmmovq() { emit 40${R[$1]}${R[$3]}$(le64 $2) "rmmovq %$1, $2(%$3)"; }
+mrmovq() { emit 50${R[$3]}${R[$2]}$(le64 $1) "mrmovq $1(%$2), %$3"; }
+addq()   { emit 60${R[$1]}${R[$2]} "addq %$1, %$2"; }
+subq()   { emit 61${R[$1]}${R[$2]} "subq %$1, %$2"; }
+andq()   { emit 62${R[$1]}${R[$2]} "andq %$1, %$2"; }
+xorq()   { emit 63${R[$1]}${R[$2]} "xorq %$1, %$2"; }
+jmp()    { emit 70$(le64 $(value $1)) "jmp $1"; }
+jl()     { emit 72$(le64 $(value $1)) "jl $1"; }
+je()     { emit 73$(le64 $(value $1)) "je $1"; }
+jne()    { emit 74$(le64 $(value $1)) "jne $1"; }
+call()   { emit 80$(le64 $(value $1)) "call $1"; }
+pushq()  { emit a0${R[$1]}f "pushq %$1"; }
+popq()   { emit b0${R[$1]}f "popq %$1"; }
+quad()   { emit $(le64 $1) ".quad $1"; }
+
+# assemble <name> - writes <name>.yo from the function <name>
+assemble()
+{
+   file="$out/$1.yo"
+   pass=1; pc=0; $1
+   pass=2; pc=0; : > "$file"; $1
+}
+
+alu()
+{
+   irmovq $iters rcx
+   irmovq 1 rdx
+   irmovq 3 rbx
+   irmovq 0 rax
+   lab loop
+   addq rbx rax
+   xorq rax rsi
+   addq rsi rdi
+   andq rdi rbx
+   addq rdx rbx
+   subq rdx rcx
+   jne loop
+   halt
+}
+
+memcpy()
+{
+   irmovq $(( iters / 32 )) r8
+   irmovq 1 r9
+   irmovq 8 r10
+   lab outer
+   irmovq src rsi
+   irmovq dst rdi
+   irmovq 32 rcx
+   lab copy
+   mrmovq 0 rsi rax
+   rmmovq rax 0 rdi
+   addq r10 rsi
+   addq r10 rdi
+   subq r9 rcx
+   jne copy
+   subq r9 r8
+   jne outer
+   halt
+   pos 0x400
+   lab src
+   for ((q = 0; q < 32; q++)); do quad $(( q * 0x0101010101 + 7 )); done
+   pos 0x600
+   lab dst
+}
+
+recursion()
+{
+   irmovq stack rsp
+   irmovq $(( iters / 64 )) r8
+   irmovq 1 r9
+   lab outer
+   irmovq 64 rdi
+   call sum
+   subq r9 r8
+   jne outer
+   halt
+   lab sum
+   andq rdi rdi
+   je done
+   pushq rdi
+   subq r9 rdi
+   call sum
+   popq rdi
+   addq rdi rax
+   lab done
+   ret
+   pos 0xff8
+   lab stack
+}
+
+branch()
+{
+   irmovq $iters rcx
+   irmovq 1 r9
+   irmovq 0x5bd1e9955bd1e995 r10
+   irmovq 8 r11
+   irmovq 32 r12
+   irmovq 0 rax
+   lab loop
+   addq r10 rdx
+   rrmovq rdx rbx
+   andq r11 rbx
+   je even
+   addq r9 rax
+   lab even
+   rrmovq rdx rbx
+   andq r12 rbx
+   jne high
+   subq r9 rax
+   lab high
+   rrmovq rax rbx
+   andq rbx rbx
+   jl neg
+   addq r9 rsi
+   jmp next
+   lab neg
+   addq r9 rdi
+   lab next
+   subq r9 rcx
+   jne loop
+   halt
+}
+
+pushpop()
+{
+   irmovq stack rsp
+   irmovq $iters rcx
+   irmovq 1 r9
+   lab loop
+   pushq rax
+   pushq rbx
+   pushq rcx
+   pushq rdx
+   popq rdx
+   popq rcx
+   popq rbx
+   popq rax
+   addq r9 rax
+   subq r9 rcx
+   jne loop
+   halt
+   pos 0xff8
+   lab stack
+}
+
+for workload in alu memcpy recursion branch pushpop
+do
+   assemble $workload
+done